@@ -1,19 +1,31 @@
 from setuptools import setup, Extension
 from pybind11 import get_cmake_dir
 import pybind11
-from pathlib import Path
+import os
+
+# CMake 构建时通过 RVV_CORE_LIB 传入已编译的静态库 rvv_core，
+# 扩展只编译绑定层；单独 pip install 时才回退为直接编译内核。
+# rvv_c.cpp 是给 C 调用方的 ABI，不进入 Python 扩展。
+rvv_core_lib = os.environ.get("RVV_CORE_LIB")
+if rvv_core_lib:
+    sources = ["src/pybind_rvv.cpp"]
+    extra_objects = [rvv_core_lib]
+else:
+    sources = ["src/pybind_rvv.cpp", "src/rvv.cpp"]
+    extra_objects = []
 
 ext_modules = [
     Extension(
         "rvv",
-        sorted(map(str, Path("src").glob("*.cpp"))),
+        sources,
         include_dirs=[
             "src",
             pybind11.get_include(),
         ],
         language="c++",
         cppstd=17,
-        extra_compile_args=["-O3", "-march=rv64gcv0p7"],
+        extra_objects=extra_objects,
+        extra_compile_args=["-O3", "-march=rv64gcv0p7", "-fvisibility=hidden"],
     ),
 ]
 
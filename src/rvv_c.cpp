@@ -0,0 +1,87 @@
+#include "rvv_c.h"
+#include "rvv.hpp"
+
+// 薄封装：直接转发到 rvv::core，不做任何额外检查或拷贝
+extern "C" {
+
+//--------------------------------------
+// 向量级运算
+//--------------------------------------
+void rvv_add(const float* a, const float* b, float* c, size_t n) {
+    rvv::core::add(a, b, c, n);
+}
+
+void rvv_sub(const float* a, const float* b, float* c, size_t n) {
+    rvv::core::sub(a, b, c, n);
+}
+
+void rvv_scale(const float* a, float k, float* b, size_t n) {
+    rvv::core::scale(a, k, b, n);
+}
+
+float rvv_dot(const float* a, const float* b, size_t n) {
+    return rvv::core::dot(a, b, n);
+}
+
+float rvv_norm_l2(const float* a, size_t n) {
+    return rvv::core::norm_l2(a, n);
+}
+
+void rvv_normalize(const float* a, float* b, size_t n) {
+    rvv::core::normalize(a, b, n);
+}
+
+//--------------------------------------
+// 矩阵运算
+//--------------------------------------
+void rvv_add2d(const float* A, const float* B, float* C,
+               size_t rows, size_t cols) {
+    rvv::core::add2d(A, B, C, rows, cols);
+}
+
+void rvv_scale2d(const float* A, float k, float* B,
+                 size_t rows, size_t cols) {
+    rvv::core::scale2d(A, k, B, rows, cols);
+}
+
+void rvv_matmul(const float* A, const float* B, float* C,
+                size_t rows, size_t k, size_t cols) {
+    rvv::core::matmul(A, B, C, rows, k, cols);
+}
+
+void rvv_transpose(const float* A, float* B,
+                   size_t rows, size_t cols) {
+    rvv::core::transpose(A, B, rows, cols);
+}
+
+void rvv_mv(const float* A, const float* x, float* y,
+            size_t rows, size_t cols) {
+    rvv::core::mv(A, x, y, rows, cols);
+}
+
+//--------------------------------------
+// int8 运算
+//--------------------------------------
+void rvv_add_i8(const int8_t* a, const int8_t* b, int8_t* c, size_t n) {
+    rvv::core::add_i8(a, b, c, n);
+}
+
+void rvv_scale_i8(const int8_t* a, int8_t k, int8_t* b, size_t n) {
+    rvv::core::scale_i8(a, k, b, n);
+}
+
+int32_t rvv_dot_i8(const int8_t* a, const int8_t* b, size_t n) {
+    return rvv::core::dot_i8(a, b, n);
+}
+
+void rvv_add2d_i8(const int8_t* A, const int8_t* B, int8_t* C,
+                  size_t rows, size_t cols) {
+    rvv::core::add2d_i8(A, B, C, rows, cols);
+}
+
+void rvv_scale2d_i8(const int8_t* A, int8_t k, int8_t* B,
+                    size_t rows, size_t cols) {
+    rvv::core::scale2d_i8(A, k, B, rows, cols);
+}
+
+}  // extern "C"
@@ -0,0 +1,85 @@
+#ifndef RVV_C_H
+#define RVV_C_H
+
+/*
+ * rvv::core 的 C ABI 封装
+ * 与 rvv.hpp 一一对应，函数名统一加 rvv_ 前缀，
+ * C / C++ 调用方可直接链接 rvv_core，无需 Python。
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include "rvv_export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ------------------------------------------------------------------
+ * float32 向量运算
+ * ------------------------------------------------------------------ */
+/** 向量加法 c = a + b */
+RVV_API void rvv_add(const float* a, const float* b, float* c, size_t n);
+
+/** 向量减法 c = a - b */
+RVV_API void rvv_sub(const float* a, const float* b, float* c, size_t n);
+
+/** 标量乘法 b = k * a */
+RVV_API void rvv_scale(const float* a, float k, float* b, size_t n);
+
+/** 向量点积 */
+RVV_API float rvv_dot(const float* a, const float* b, size_t n);
+
+/** L2 范数 ||a||_2 */
+RVV_API float rvv_norm_l2(const float* a, size_t n);
+
+/** 向量归一化 b = a / ||a||_2 */
+RVV_API void rvv_normalize(const float* a, float* b, size_t n);
+
+/* ------------------------------------------------------------------
+ * float32 矩阵运算（行主序）
+ * ------------------------------------------------------------------ */
+/** 矩阵加法 C = A + B */
+RVV_API void rvv_add2d(const float* A, const float* B, float* C,
+                       size_t rows, size_t cols);
+
+/** 矩阵标量乘法 B = k * A */
+RVV_API void rvv_scale2d(const float* A, float k, float* B,
+                         size_t rows, size_t cols);
+
+/** 矩阵乘法 C = A * B，A:[rows×k]  B:[k×cols]  → C:[rows×cols] */
+RVV_API void rvv_matmul(const float* A, const float* B, float* C,
+                        size_t rows, size_t k, size_t cols);
+
+/** 矩阵转置 B = A^T */
+RVV_API void rvv_transpose(const float* A, float* B,
+                           size_t rows, size_t cols);
+
+/** 矩阵 × 向量 y = A * x，A:[rows×cols]  x:[cols]  → y:[rows] */
+RVV_API void rvv_mv(const float* A, const float* x, float* y,
+                    size_t rows, size_t cols);
+
+/* ------------------------------------------------------------------
+ * int8 向量/矩阵运算
+ * ------------------------------------------------------------------ */
+/** int8 向量加法 c = a + b */
+RVV_API void rvv_add_i8(const int8_t* a, const int8_t* b, int8_t* c, size_t n);
+
+/** int8 标量乘法 b = k * a */
+RVV_API void rvv_scale_i8(const int8_t* a, int8_t k, int8_t* b, size_t n);
+
+/** int8 向量点积（累加到 int32） */
+RVV_API int32_t rvv_dot_i8(const int8_t* a, const int8_t* b, size_t n);
+
+/** int8 矩阵加法 C = A + B */
+RVV_API void rvv_add2d_i8(const int8_t* A, const int8_t* B, int8_t* C,
+                          size_t rows, size_t cols);
+
+/** int8 矩阵标量乘法 B = k * A */
+RVV_API void rvv_scale2d_i8(const int8_t* A, int8_t k, int8_t* B,
+                            size_t rows, size_t cols);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* RVV_C_H */
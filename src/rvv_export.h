@@ -0,0 +1,15 @@
+#ifndef RVV_EXPORT_H
+#define RVV_EXPORT_H
+
+/*
+ * rvv_core 符号导出宏
+ * rvv_core 以 -fvisibility=hidden 编译，动态库中只导出 RVV_API 标注的公开接口；
+ * 静态库（含链进 Python 扩展时）不额外导出任何符号。
+ */
+#if defined(RVV_CORE_EXPORTS) && defined(__GNUC__)
+#define RVV_API __attribute__((visibility("default")))
+#else
+#define RVV_API
+#endif
+
+#endif  /* RVV_EXPORT_H */
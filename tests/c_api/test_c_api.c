@@ -0,0 +1,111 @@
+/*
+ * C ABI 冒烟测试：通过 find_package(rvv_core) 链接，校验 rvv_* 结果
+ */
+#include <math.h>
+#include <stdio.h>
+#include "rvv_c.h"
+
+static int failures = 0;
+
+#define CHECK(cond)                                                   \
+    do {                                                              \
+        if (!(cond)) {                                                \
+            fprintf(stderr, "%s:%d: check failed: %s\n",              \
+                    __FILE__, __LINE__, #cond);                       \
+            ++failures;                                               \
+        }                                                             \
+    } while (0)
+
+static int near(float x, float y) { return fabsf(x - y) < 1e-5f; }
+
+static void test_vector(void) {
+    const float a[4] = {1, 2, 3, 4};
+    const float b[4] = {5, 6, 7, 8};
+    float c[4];
+    size_t i;
+
+    rvv_add(a, b, c, 4);
+    for (i = 0; i < 4; ++i) CHECK(near(c[i], a[i] + b[i]));
+
+    rvv_sub(a, b, c, 4);
+    for (i = 0; i < 4; ++i) CHECK(near(c[i], a[i] - b[i]));
+
+    rvv_scale(a, 3.0f, c, 4);
+    for (i = 0; i < 4; ++i) CHECK(near(c[i], a[i] * 3.0f));
+
+    CHECK(near(rvv_dot(a, b, 4), 70.0f));
+    CHECK(near(rvv_norm_l2(a, 4), sqrtf(30.0f)));
+
+    rvv_normalize(a, c, 4);
+    CHECK(near(rvv_norm_l2(c, 4), 1.0f));
+}
+
+static void test_matrix(void) {
+    /* A:[2×3]  B:[3×2] */
+    const float A[6] = {1, 2, 3, 4, 5, 6};
+    const float B[6] = {7, 8, 9, 10, 11, 12};
+    const float x[3] = {1, 0, -1};
+    const float AB[4] = {58, 64, 139, 154};
+    const float AT[6] = {1, 4, 2, 5, 3, 6};
+    float C[6];
+    float y[2];
+    size_t i;
+
+    rvv_matmul(A, B, C, 2, 3, 2);
+    for (i = 0; i < 4; ++i) CHECK(near(C[i], AB[i]));
+
+    rvv_transpose(A, C, 2, 3);
+    for (i = 0; i < 6; ++i) CHECK(near(C[i], AT[i]));
+
+    rvv_mv(A, x, y, 2, 3);
+    CHECK(near(y[0], -2.0f));
+    CHECK(near(y[1], -2.0f));
+
+    rvv_add2d(A, B, C, 2, 3);
+    for (i = 0; i < 6; ++i) CHECK(near(C[i], A[i] + B[i]));
+
+    rvv_scale2d(A, -0.5f, C, 2, 3);
+    for (i = 0; i < 6; ++i) CHECK(near(C[i], A[i] * -0.5f));
+}
+
+static void test_int8(void) {
+    const int8_t a[4] = {1, -2, 3, -4};
+    const int8_t b[4] = {5, 6, -7, 8};
+    int8_t c[4];
+    size_t i;
+
+    rvv_add_i8(a, b, c, 4);
+    for (i = 0; i < 4; ++i) CHECK(c[i] == (int8_t)(a[i] + b[i]));
+
+    rvv_scale_i8(a, 2, c, 4);
+    for (i = 0; i < 4; ++i) CHECK(c[i] == (int8_t)(a[i] * 2));
+
+    CHECK(rvv_dot_i8(a, b, 4) == -60);
+}
+
+static void test_matrix_int8(void) {
+    /* A, B:[2×3] */
+    const int8_t A[6] = {1, -2, 3, -4, 5, -6};
+    const int8_t B[6] = {10, 20, -30, 40, -50, 60};
+    int8_t C[6];
+    size_t i;
+
+    rvv_add2d_i8(A, B, C, 2, 3);
+    for (i = 0; i < 6; ++i) CHECK(C[i] == (int8_t)(A[i] + B[i]));
+
+    rvv_scale2d_i8(A, -3, C, 2, 3);
+    for (i = 0; i < 6; ++i) CHECK(C[i] == (int8_t)(A[i] * -3));
+}
+
+int main(void) {
+    test_vector();
+    test_matrix();
+    test_int8();
+    test_matrix_int8();
+    if (failures) {
+        fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("c_api: all checks passed\n");
+    return 0;
+}